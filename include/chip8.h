@@ -2,29 +2,32 @@
 #ifndef CHIP8
 #define CHIP8
 #include <string>
-#include <SDL2/SDL.h>
+#include <cstddef>
 
 using namespace std;
-class chip8 {
+// The registers touched on every cycle (opcode through debugMode) are
+// grouped at the front so they share the first cache line. key, memory
+// and gfx are cold and each start on their own line after them.
+class alignas(64) chip8 {
 public:
     chip8() : debugMode{false} {}
     chip8(const bool debug) : debugMode{debug} {}
 
-    const bool debugMode;
     unsigned short opcode;
-    unsigned char memory[4096];
-    unsigned char V[16];
-    unsigned short I;
     unsigned short pc;
-    unsigned char gfx[2048];
+    unsigned short I;
+    unsigned short sp;
+    unsigned char V[16];
+    unsigned short cstack[16];
     unsigned char delayTimer;
     unsigned char soundTimer;
-    unsigned short cstack[16];
-    unsigned short sp;
-    unsigned char key[16];
     bool drawFlag;
+    const bool debugMode;
+
+    alignas(64) unsigned char key[16];
+    alignas(64) unsigned char memory[4096];
+    alignas(64) unsigned char gfx[2048];
     static const unsigned char fontset[];
-    SDL_Event event;
 
     void initialize();
     void emulateCycle();
@@ -37,4 +40,8 @@ public:
     void _unknown();
 };
 
+// Adding a field to the hot block must not push it past one cache line.
+static_assert(offsetof(chip8, key) == 64, "chip8 hot registers exceed one cache line");
+static_assert(offsetof(chip8, memory) == 128, "chip8 memory is not cache line aligned");
+
 #endif
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <time.h>
 #include <bitset>
+#include <SDL2/SDL.h>
 #include "chip8.h"
 
 void chip8::initialize() {
@@ -252,6 +253,7 @@ std::cout << "Next Opcode: " << std::hex << opcode << std::endl;
                 case 0x000A:
                 {
                     bool keypressed{false};
+                    SDL_Event event;
                     while (!keypressed) {
                         while (SDL_PollEvent(&event)) {
                             switch(event.type) {
@@ -416,21 +418,20 @@ void chip8::loadGame(char* gamePath) {
     fseek(gameBinary, 0, SEEK_END);
     long binarySize{ftell(gameBinary)};
     rewind(gameBinary);
-    unsigned char *buffer{(unsigned char*) malloc(sizeof(unsigned char) * binarySize)};
-    if (buffer == NULL) {fputs("Memory error.\n", stderr); exit(2);}
+    if (binarySize < 0) {fputs("File error.\n", stderr); exit(1);}
+    if (binarySize > 4096 - 512) {fputs("ROM too large.\n", stderr); exit(2);}
+    size_t romSize{static_cast<size_t>(binarySize)};
 
-    size_t result{fread(buffer, 1, binarySize, gameBinary)};
-    if (result != binarySize) {fputs("Reading error.\n", stderr); exit(3);}
+    // Read straight into program memory; no intermediate buffer is needed.
+    size_t result{fread(memory + 512, 1, romSize, gameBinary)};
+    if (result != romSize) {fputs("Reading error.\n", stderr); exit(3);}
     fclose(gameBinary);
-
-    for (int i{0}; i < binarySize; ++i)
-        memory[i + 512] = buffer[i];
-    free(buffer);
 }
 
 void chip8::setKeys() {
     for (int i{0}; i < 16; ++i)
         key[i] = 0;
+    SDL_Event event;
     while (SDL_PollEvent(&event)) {
         switch(event.type) {
             case SDL_QUIT: